@@ -137,6 +137,86 @@ TEST_CASE ("assignment operator [%7]", "[op=]")
   }
 }
 
+/*----------------------------------------------------------*/
+/* MOVE CTOR AND MOVE ASSIGNMENT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * TAKE POINTS FROM OTHER TESTS TO SCORE THESE
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using std::is_nothrow_move_assignable;
+using std::is_nothrow_move_constructible;
+using std::move;
+using std::swap;
+using std::vector;
+
+TEST_CASE ("move constructor and move assignment [%0]", "[move]")
+{
+  List<int> list_a { 1, 2, 3 };
+  List<int> list_b { 4, 5, 6 };
+  List<int>::iterator first = list_a.begin ();
+
+  ostringstream output;
+
+  SECTION ("move constructor [%0]")
+  {
+    List<int> list_c (move (list_a));
+
+    output << list_c;
+    REQUIRE (output.str () == "[ 1 2 3 ]");
+    // Nodes are stolen, not copied.
+    REQUIRE (first == list_c.begin ());
+    REQUIRE (is_nothrow_move_constructible<List<int>>::value);
+  }
+
+  SECTION ("move constructor - source is empty and usable [%0]")
+  {
+    List<int> list_c (move (list_a));
+
+    REQUIRE (list_a.empty ());
+    REQUIRE (list_a.size () == 0);
+    REQUIRE (list_a.begin () == list_a.end ());
+
+    list_a.push_back (7);
+    output << list_a;
+    REQUIRE (output.str () == "[ 7 ]");
+  }
+
+  SECTION ("move assignment operator [%0]")
+  {
+    list_b = move (list_a);
+
+    output << list_b;
+    REQUIRE (output.str () == "[ 1 2 3 ]");
+    REQUIRE (first == list_b.begin ());
+    REQUIRE (list_a.empty ());
+    REQUIRE (is_nothrow_move_assignable<List<int>>::value);
+  }
+
+  SECTION ("swap [%0]")
+  {
+    swap (list_a, list_b);
+
+    output << list_a << list_b;
+    REQUIRE (output.str () == "[ 4 5 6 ][ 1 2 3 ]");
+    REQUIRE (first == list_b.begin ());
+  }
+
+  SECTION ("vector of lists [%0]")
+  {
+    vector<List<int>> lists;
+
+    for (int i = 0; i < 100; ++i)
+    {
+      lists.push_back (List<int> { i, i + 1 });
+    }
+
+    output << lists.front () << lists.back ();
+    REQUIRE (output.str () == "[ 0 1 ][ 99 100 ]");
+  }
+}
+*/
 /*----------------------------------------------------------*/
 
 TEST_CASE ("empty [%1]", "[empty]")
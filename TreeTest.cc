@@ -48,10 +48,12 @@ using std::vector;
 template<typename T> void REQUIRE_TREE (const SearchTree<T>& t, string treeString);
 template<typename T> void REQUIRE_TREE (const SearchTree<T>& t, string treeString, int depth);
 template<typename T> void REQUIRE_HEAD (const SearchTree<T>& tree, T left, T right, T parent);
+template<typename T> void REQUIRE_HEAD_MIN_MAX (const SearchTree<T>& tree, T right, T left);
 template<typename T> void REQUIRE_HEAD_NULL (const SearchTree<T>& tree);
 template<typename T> void REQUIRE_LEVEL_ORDER (const SearchTree<T>& tree, string answer);
 template<typename T> void tree_insert (SearchTree<T>& tree, const vector<T>& values);
 template<typename T> void tree_erase (SearchTree<T>& tree, const vector<T>& values);
+template<typename T> void big_rand_insert (SearchTree<T>& tree, set<T>& values, int count);
 template<typename T> void REQUIRE_ALL_EQUAL (const vector<T>& values);
 void CHECK_AND_WARN (bool condition, string message);
 ostringstream CHECK_AND_WARN (bool condition, string message, ostringstream stream);
@@ -261,6 +263,43 @@ TEST_CASE ("copy constructor", "7")
 
 /*----------------------------------------------------------*/
 
+/* COPY SHAPE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, end, size, copy constructor
+TEST_CASE ("copy constructor - big tree", "0")
+{
+  SearchTree<int> tree_a;
+
+  set<int> big_rand;
+  big_rand_insert (tree_a, big_rand, 10000);
+
+  int min = * big_rand.begin();
+  int max = * (--big_rand.end());
+  const Node<int>* root_a = tree_a.end().m_nodePtr->parent;
+
+  SearchTree<int> tree_b (tree_a);
+
+  // A copy that re-inserts values in order gives a chain rooted at the minimum.
+  SECTION ("copy constructor - big tree - depth of tree", "0")
+  {
+    REQUIRE (tree_b.depth() == tree_a.depth());
+  }
+
+  SECTION ("copy constructor - big tree - size of tree", "0")
+  {
+    REQUIRE (tree_b.size() == big_rand.size());
+  }
+
+  SECTION ("copy constructor - big tree - head links", "0")
+  {
+    REQUIRE (root_a != nullptr);
+    REQUIRE_HEAD (tree_b, min, max, root_a->data);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
 TEST_CASE ("empty", "1")
 {
   SearchTree<int> tree;
@@ -1454,235 +1493,1976 @@ TEST_CASE ("make string tree", "1")
 
 /*----------------------------------------------------------*/
 
+/* SELECT AND RANK NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
 // Dependencies: insert, erase, end, clear, iterator dereference, copy constructor
-TEST_CASE ("stress test", "2")
+TEST_CASE ("select and rank", "0")
 {
-  SECTION ("stress test", "[2.00]")
-  {
-    SearchTree<int> tree_a;
-
-    set<int> big_rand;
-    mt19937 gen (0);
-    int root = (gen () % 1000 ) + 19500;
-    big_rand.insert (root);
-    tree_a.insert(root);
+  SearchTree<int> tree;
+  tree_insert (tree, { 4, 2, 6, 1, 3, 5, 7 });
 
-    for (int i = 1; i < 20000; ++i)
+  SECTION ("select - every position", "0")
+  {
+    for (size_t k = 0; k < 7; ++k)
     {
-      int temp = gen () % 40000;
-      big_rand.insert (temp);
-      tree_a.insert(temp);
+      REQUIRE (* tree.select (k) == static_cast<int> (k) + 1);
     }
+  }
 
-    int min = * big_rand.begin();
-    int max = * (--big_rand.end());
-
-    string big_rand_string = "[ ";
-    for (int num : big_rand)
-    {
-      big_rand_string += to_string(num) + " ";
-    }
-    big_rand_string += "]";
+  SECTION ("select - past last position", "0")
+  {
+    REQUIRE (tree.select (7) == tree.end());
+  }
 
-    // Done without "REQUIRE" to avoid long error messages.
-    ostringstream stream;
-    stream << "[ ";
-    tree_a.printInOrder (stream);
-    stream << "]";
-    if (stream.str () != big_rand_string)
-    {
-      FAIL ("Tree state incorrect. Tree size too large to display.");
-    }
+  SECTION ("rank - values in tree", "0")
+  {
+    REQUIRE (tree.rank (1) == 0);
+    REQUIRE (tree.rank (4) == 3);
+    REQUIRE (tree.rank (7) == 6);
+  }
 
-    REQUIRE (tree_a.depth() == 30);
-    REQUIRE (tree_a.size() == big_rand.size());
-    REQUIRE_HEAD (tree_a, min, max, root);
+  SECTION ("rank - values not in tree", "0")
+  {
+    REQUIRE (tree.rank (0) == 0);
+    REQUIRE (tree.rank (8) == 7);
+  }
 
-    SearchTree<int> tree_b (tree_a);
-    tree_b.clear ();
+  SECTION ("select and rank - after erase", "0")
+  {
+    tree_erase (tree, { 4, 1 });
 
-    REQUIRE_TREE (tree_b, "[ ]", -1);
-    REQUIRE (tree_b.size() == 0);
-    REQUIRE_HEAD_NULL (tree_b);
+    REQUIRE (* tree.select (0) == 2);
+    REQUIRE (* tree.select (2) == 5);
+    REQUIRE (tree.rank (6) == 3);
+  }
 
-    while (tree_a.size() > 0)
-    {
-      tree_a.erase (* (--tree_a.end()));
-    }
+  SECTION ("select and rank - after copy construct", "0")
+  {
+    SearchTree<int> tree_b (tree);
+    tree_b.insert (8);
 
-    REQUIRE_TREE (tree_a, "[ ]", -1);
-    REQUIRE (tree_a.size() == 0);
-    REQUIRE_HEAD_NULL (tree_a);
+    REQUIRE (* tree_b.select (7) == 8);
+    REQUIRE (tree.select (7) == tree.end());
+  }
 
-    tree_insert (tree_a, { 4, 2, 6, 1, 3, 5, 7 });
+  SECTION ("select and rank - after clear", "0")
+  {
+    tree.clear();
+    tree.insert (9);
 
-    REQUIRE_TREE (tree_a, "[ 1 2 3 4 5 6 7 ]", 2);
-    REQUIRE (tree_a.size() == 7);
-    REQUIRE_HEAD (tree_a, 1, 7, 4);
+    REQUIRE (* tree.select (0) == 9);
+    REQUIRE (tree.rank (9) == 0);
   }
 }
+*/
+/*----------------------------------------------------------*/
 
-/************************************************************/
-// Helpers
+/* RANGE CONSTRUCTOR NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+using std::distance;
 
-template<typename T>
-void
-REQUIRE_TREE (const SearchTree<T>& tree, string treeString)
+// Dependencies: end, iterator decrement
+TEST_CASE ("range constructor", "0")
 {
-  ostringstream output;
-  output << "[ ";
-  tree.printInOrder(output);
-  output << "]";
-  REQUIRE (output.str () == treeString);
-}
+  SECTION ("range constructor - from sorted range", "0")
+  {
+    vector<int> values { 1, 2, 3, 4, 5, 6, 7 };
+    SearchTree<int> tree (values.begin(), values.end());
 
-/*----------------------------------------------------------*/
+    REQUIRE_TREE (tree, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree.size() == 7);
+    REQUIRE_HEAD (tree, 1, 7, 4);
+    REQUIRE_LEVEL_ORDER (tree, "[ 4 | 2 6 | 1 3 5 7 ]");
+  }
 
-template<typename T>
-void
-REQUIRE_TREE (const SearchTree<T>& tree, string treeString, int depth)
-{
-  REQUIRE_TREE (tree, treeString);
-  REQUIRE (tree.depth() == depth);
-}
+  SECTION ("range constructor - from unsorted range", "0")
+  {
+    vector<int> values { 5, 1, 7, 3, 2, 6, 4 };
+    SearchTree<int> tree (values.begin(), values.end());
 
-/*----------------------------------------------------------*/
+    REQUIRE_TREE (tree, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree.size() == 7);
+    REQUIRE_HEAD (tree, 1, 7, 4);
+  }
 
-template<typename T>
-void
-REQUIRE_HEAD (const SearchTree<T>& tree, T right, T left, T parent)
-{
-  const Node<T>* head = tree.end().m_nodePtr;
+  SECTION ("range constructor - duplicate values", "0")
+  {
+    vector<int> values { 1, 1, 2, 3, 3, 3, 4, 5, 6, 7, 7 };
+    SearchTree<int> tree (values.begin(), values.end());
 
-  REQUIRE (head->right != nullptr);
-  REQUIRE (head->left != nullptr);
-  REQUIRE (head->parent != nullptr);
+    REQUIRE_TREE (tree, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree.size() == 7);
+  }
 
-  REQUIRE (head->right != head);
-  REQUIRE (head->left != head);
-  REQUIRE (head->parent != head);
+  SECTION ("range constructor - empty range", "0")
+  {
+    vector<int> values;
+    SearchTree<int> tree (values.begin(), values.end());
 
-  REQUIRE (head->right->data == right);
-  REQUIRE (head->left->data == left);
-  REQUIRE (head->parent->data == parent);
-}
+    REQUIRE_TREE (tree, "[ ]", -1);
+    REQUIRE (tree.size() == 0);
+    REQUIRE_HEAD_NULL (tree);
+  }
 
-/*----------------------------------------------------------*/
+  SECTION ("range constructor - big sorted range", "0")
+  {
+    vector<int> values;
+    for (int i = 0; i < 20000; ++i)
+    {
+      values.push_back (i);
+    }
 
-template<typename T>
-void
-REQUIRE_HEAD_NULL (const SearchTree<T>& tree)
-{
-  const Node<T>* head = tree.end().m_nodePtr;
+    SearchTree<int> tree (values.begin(), values.end());
 
-  REQUIRE (head->left == nullptr);
-  REQUIRE (head->right == nullptr);
-  REQUIRE (head->parent == nullptr);
-}
+    REQUIRE (tree.depth() == 14);
+    REQUIRE (tree.size() == 20000);
+    REQUIRE (* tree.begin() == 0);
+    REQUIRE (* (--tree.end()) == 19999);
 
+    // Parent links must let the iterator walk the whole tree.
+    REQUIRE (distance (tree.begin(), tree.end()) == 20000);
+  }
+}
+*/
 /*----------------------------------------------------------*/
 
-template<typename T>
-void
-REQUIRE_LEVEL_ORDER (const SearchTree<T>& tree, string answer)
+/* MOVE CTOR AND MOVE ASSIGNMENT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+#include <type_traits>
+#include <utility>
+
+using std::is_nothrow_move_assignable;
+using std::is_nothrow_move_constructible;
+using std::move;
+using std::swap;
+
+// Dependencies: insert, end, iterator decrement
+TEST_CASE ("move constructor and move assignment", "0")
 {
-  ostringstream os;
-  string out, out_no_space, out_no_dash, answer_no_space, answer_no_dash;
+  SearchTree<int> tree_a;
+  SearchTree<int> tree_b;
 
-  os << tree;
-  out = os.str();
+  tree_insert (tree_a, { 4, 2, 6, 1, 3, 5, 7 });
+  tree_insert (tree_b, { 9, 8 });
 
-  out_no_space = out_no_dash = out;
-  answer_no_dash = answer_no_space = answer;
+  const Node<int>* root = tree_a.end().m_nodePtr->parent;
 
-  out_no_space.erase(remove(out_no_space.begin(), out_no_space.end(), ' '), out_no_space.end());
-  out_no_dash.erase(remove(out_no_dash.begin(), out_no_dash.end(), '-'), out_no_dash.end());
+  SECTION ("move constructor - state of tree", "0")
+  {
+    SearchTree<int> tree_c (move (tree_a));
 
-  answer_no_space.erase(remove(answer_no_space.begin(), answer_no_space.end(), ' '),
-    answer_no_space.end());
-  answer_no_dash.erase(remove(answer_no_dash.begin(), answer_no_dash.end(), '-'),
-    answer_no_dash.end());
+    REQUIRE_TREE (tree_c, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree_c.size() == 7);
+    REQUIRE_HEAD (tree_c, 1, 7, 4);
+    // Nodes are stolen, not copied.
+    REQUIRE (tree_c.end().m_nodePtr->parent == root);
+    REQUIRE (root->parent == tree_c.end().m_nodePtr);
+    REQUIRE (is_nothrow_move_constructible<SearchTree<int>>::value);
+  }
 
-  CHECK (out == answer);
+  SECTION ("move constructor - source is empty and usable", "0")
+  {
+    SearchTree<int> tree_c (move (tree_a));
 
-  if (out != answer)
+    REQUIRE_TREE (tree_a, "[ ]", -1);
+    REQUIRE (tree_a.size() == 0);
+    REQUIRE_HEAD_NULL (tree_a);
+
+    tree_a.insert (10);
+    REQUIRE_HEAD (tree_a, 10, 10, 10);
+  }
+
+  SECTION ("move assignment - state of tree", "0")
   {
-    if (out_no_dash == answer_no_dash)
-    {
-      WARN ("Your output is correct except for dashes\n");
-    }
-    else if (out_no_space == answer_no_space)
-    {
-      WARN ("Your output is correct except for spaces\n");
-    }
+    tree_b = move (tree_a);
+
+    REQUIRE_TREE (tree_b, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree_b.size() == 7);
+    REQUIRE_HEAD (tree_b, 1, 7, 4);
+    REQUIRE (tree_b.end().m_nodePtr->parent == root);
+    REQUIRE (is_nothrow_move_assignable<SearchTree<int>>::value);
+
+    REQUIRE_TREE (tree_a, "[ ]", -1);
+    REQUIRE_HEAD_NULL (tree_a);
   }
-}
 
-/*----------------------------------------------------------*/
+  SECTION ("swap - state of trees", "0")
+  {
+    swap (tree_a, tree_b);
 
-template<typename T>
-void
-REQUIRE_ALL_EQUAL (const vector<T>& values)
-{
-  T temp = NULL;
+    REQUIRE_TREE (tree_a, "[ 8 9 ]", 1);
+    REQUIRE_HEAD (tree_a, 8, 9, 9);
+    REQUIRE_TREE (tree_b, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE_HEAD (tree_b, 1, 7, 4);
+    REQUIRE (root->parent == tree_b.end().m_nodePtr);
+  }
 
-  for (T value : values)
+  SECTION ("move - vector of trees", "0")
   {
-    if (temp != NULL)
+    vector<SearchTree<int>> trees;
+
+    for (int i = 0; i < 100; ++i)
     {
-      REQUIRE (temp == value);
+      trees.push_back (SearchTree<int> ());
+      trees.back().insert (i);
     }
-    temp = value;
+
+    REQUIRE_HEAD (trees.front(), 0, 0, 0);
+    REQUIRE_HEAD (trees.back(), 99, 99, 99);
   }
 }
-
+*/
 /*----------------------------------------------------------*/
 
-void
-CHECK_AND_WARN (bool condition, string message)
+/* HINTED INSERT AND ITERATOR ERASE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, find, end, iterator decrement
+TEST_CASE ("hinted insert and iterator erase", "0")
 {
-  CHECK (condition);
-  if (!condition)
+  SearchTree<int> tree;
+  SearchTree<int>::iterator iter;
+
+  SECTION ("hinted insert - correct hint", "0")
   {
-    cout << message << "\n";
+    tree_insert (tree, { 4, 2, 6 });
+    iter = tree.insert (tree.find (6), 5);
+
+    REQUIRE (iter.m_nodePtr->data == 5);
+    REQUIRE_LEVEL_ORDER (tree, "[ 4 | 2 6 | - - 5 - ]");
+    REQUIRE (tree.size() == 4);
   }
-}
 
-/*----------------------------------------------------------*/
+  SECTION ("hinted insert - wrong hint", "0")
+  {
+    tree_insert (tree, { 4, 2, 6 });
+    iter = tree.insert (tree.begin(), 7);
 
-ostringstream
-CHECK_AND_WARN (bool condition, string message, ostringstream stream)
-{
-  CHECK (condition);
-  if (!condition)
+    REQUIRE (iter.m_nodePtr->data == 7);
+    REQUIRE_LEVEL_ORDER (tree, "[ 4 | 2 6 | - - - 7 ]");
+    REQUIRE_HEAD (tree, 2, 7, 4);
+  }
+
+  SECTION ("hinted insert - duplicate value", "0")
   {
-    stream << message << "\n";
+    tree_insert (tree, { 4, 2, 6 });
+    tree.insert (tree.find (4), 4);
+
+    REQUIRE_TREE (tree, "[ 2 4 6 ]", 1);
+    REQUIRE (tree.size() == 3);
   }
 
-  return stream;
-}
+  SECTION ("hinted insert - append at end", "0")
+  {
+    for (int i = 0; i < 100; ++i)
+    {
+      tree.insert (tree.end(), i);
+    }
 
-/*----------------------------------------------------------*/
+    REQUIRE (tree.depth() == 99);
+    REQUIRE (tree.size() == 100);
+    REQUIRE_HEAD (tree, 0, 99, 0);
+  }
 
-template<typename T>
-void
-tree_insert (SearchTree<T>& tree, const vector<T>& values)
-{
-  for (T value : values)
+  SECTION ("iterator erase - return value", "0")
   {
-    tree.insert (value);
+    tree_insert (tree, { 4, 2, 6, 1, 3, 5, 7 });
+    iter = tree.erase (tree.find (4));
+
+    REQUIRE (iter.m_nodePtr->data == 5);
+    REQUIRE_TREE (tree, "[ 1 2 3 5 6 7 ]");
+    REQUIRE (tree.size() == 6);
   }
-}
 
-/*----------------------------------------------------------*/
+  SECTION ("iterator erase - maximum value", "0")
+  {
+    tree_insert (tree, { 4, 2, 6, 1, 3, 5, 7 });
+    iter = tree.erase (--tree.end());
 
-template<typename T>
-void
-tree_erase (SearchTree<T>& tree, const vector<T>& values)
-{
-  for (T value : values)
+    REQUIRE (iter == tree.end());
+    REQUIRE_HEAD (tree, 1, 6, 4);
+  }
+
+  SECTION ("iterator erase - drain tree", "0")
   {
-    tree.erase (value);
+    tree_insert (tree, { 4, 2, 6, 1, 3, 5, 7 });
+
+    iter = tree.begin();
+    while (iter != tree.end())
+    {
+      iter = tree.erase (iter);
+    }
+
+    REQUIRE_TREE (tree, "[ ]", -1);
+    REQUIRE (tree.size() == 0);
+    REQUIRE_HEAD_NULL (tree);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* BOUNDS AND RANGE ERASE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, end, iterator dereference
+TEST_CASE ("bounds and range erase", "0")
+{
+  SearchTree<int> tree;
+  tree_insert (tree, { 40, 20, 60, 10, 30, 50, 70 });
+
+  SECTION ("lower bound - value in tree", "0")
+  {
+    REQUIRE (* tree.lower_bound (30) == 30);
+  }
+
+  SECTION ("lower bound - value not in tree", "0")
+  {
+    REQUIRE (* tree.lower_bound (31) == 40);
+    REQUIRE (* tree.lower_bound (0) == 10);
+    REQUIRE (tree.lower_bound (71) == tree.end());
+  }
+
+  SECTION ("upper bound", "0")
+  {
+    REQUIRE (* tree.upper_bound (30) == 40);
+    REQUIRE (* tree.upper_bound (35) == 40);
+    REQUIRE (tree.upper_bound (70) == tree.end());
+  }
+
+  SECTION ("equal range", "0")
+  {
+    pair<SearchTree<int>::iterator, SearchTree<int>::iterator> range = tree.equal_range (50);
+    REQUIRE (* range.first == 50);
+    REQUIRE (* range.second == 60);
+
+    range = tree.equal_range (55);
+    REQUIRE (range.first == range.second);
+  }
+
+  // count_range counts values in [lo, hi).
+  SECTION ("count range", "0")
+  {
+    REQUIRE (tree.count_range (20, 60) == 4);
+    REQUIRE (tree.count_range (21, 59) == 3);
+    REQUIRE (tree.count_range (0, 100) == 7);
+    REQUIRE (tree.count_range (41, 49) == 0);
+  }
+
+  SECTION ("range erase - middle", "0")
+  {
+    SearchTree<int>::iterator iter
+      = tree.erase (tree.lower_bound (20), tree.lower_bound (60));
+
+    REQUIRE (* iter == 60);
+    REQUIRE_TREE (tree, "[ 10 60 70 ]");
+    REQUIRE (tree.size() == 3);
+    REQUIRE_HEAD_MIN_MAX (tree, 10, 70);
+  }
+
+  SECTION ("range erase - front and back", "0")
+  {
+    tree.erase (tree.begin(), tree.lower_bound (30));
+    tree.erase (tree.upper_bound (50), tree.end());
+
+    REQUIRE_TREE (tree, "[ 30 40 50 ]");
+    REQUIRE (tree.size() == 3);
+    REQUIRE_HEAD_MIN_MAX (tree, 30, 50);
+  }
+
+  SECTION ("range erase - all", "0")
+  {
+    SearchTree<int>::iterator iter = tree.erase (tree.begin(), tree.end());
+
+    REQUIRE (iter == tree.end());
+    REQUIRE_TREE (tree, "[ ]", -1);
+    REQUIRE (tree.size() == 0);
+    REQUIRE_HEAD_NULL (tree);
+  }
+
+  SECTION ("range erase - empty range", "0")
+  {
+    tree.erase (tree.find (50), tree.find (50));
+
+    REQUIRE_TREE (tree, "[ 10 20 30 40 50 60 70 ]", 2);
+    REQUIRE (tree.size() == 7);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SPLIT AND JOIN NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+#include <utility>
+
+using std::move;
+
+// Dependencies: insert, find, end, move constructor
+TEST_CASE ("split and join", "0")
+{
+  SearchTree<int> tree;
+  tree_insert (tree, { 40, 20, 60, 10, 30, 50, 70 });
+
+  const Node<int>* node_30 = tree.find (30).m_nodePtr;
+  const Node<int>* node_60 = tree.find (60).m_nodePtr;
+
+  SECTION ("split - value in tree", "0")
+  {
+    pair<SearchTree<int>, SearchTree<int>> parts = SearchTree<int>::split (move (tree), 40);
+
+    REQUIRE_TREE (parts.first, "[ 10 20 30 ]");
+    REQUIRE (parts.first.size() == 3);
+    REQUIRE_HEAD_MIN_MAX (parts.first, 10, 30);
+
+    REQUIRE_TREE (parts.second, "[ 40 50 60 70 ]");
+    REQUIRE (parts.second.size() == 4);
+    REQUIRE_HEAD_MIN_MAX (parts.second, 40, 70);
+  }
+
+  SECTION ("split - nodes are relinked, not copied", "0")
+  {
+    pair<SearchTree<int>, SearchTree<int>> parts = SearchTree<int>::split (move (tree), 45);
+
+    REQUIRE (parts.first.find (30).m_nodePtr == node_30);
+    REQUIRE (parts.second.find (60).m_nodePtr == node_60);
+  }
+
+  SECTION ("split - pivot outside tree", "0")
+  {
+    pair<SearchTree<int>, SearchTree<int>> parts = SearchTree<int>::split (move (tree), 100);
+
+    REQUIRE_TREE (parts.first, "[ 10 20 30 40 50 60 70 ]");
+    REQUIRE (parts.second.size() == 0);
+    REQUIRE_HEAD_NULL (parts.second);
+  }
+
+  SECTION ("join - split halves", "0")
+  {
+    pair<SearchTree<int>, SearchTree<int>> parts = SearchTree<int>::split (move (tree), 35);
+    SearchTree<int> joined = SearchTree<int>::join (move (parts.first), move (parts.second));
+
+    REQUIRE_TREE (joined, "[ 10 20 30 40 50 60 70 ]");
+    REQUIRE (joined.size() == 7);
+    REQUIRE_HEAD_MIN_MAX (joined, 10, 70);
+    REQUIRE (joined.find (30).m_nodePtr == node_30);
+    REQUIRE (joined.find (60).m_nodePtr == node_60);
+  }
+
+  SECTION ("join - with empty tree", "0")
+  {
+    SearchTree<int> empty;
+    SearchTree<int> joined = SearchTree<int>::join (move (empty), move (tree));
+
+    REQUIRE_TREE (joined, "[ 10 20 30 40 50 60 70 ]", 2);
+    REQUIRE_HEAD (joined, 10, 70, 40);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SET OPERATIONS NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, end
+TEST_CASE ("set operations", "0")
+{
+  SearchTree<int> tree_a;
+  SearchTree<int> tree_b;
+
+  // Both skewed so the results must be rebuilt, not copied.
+  tree_insert (tree_a, { 1, 2, 3, 4, 5, 6 });
+  tree_insert (tree_b, { 9, 7, 6, 5, 4 });
+
+  SECTION ("set union", "0")
+  {
+    SearchTree<int> result = set_union (tree_a, tree_b);
+
+    REQUIRE_TREE (result, "[ 1 2 3 4 5 6 7 9 ]", 3);
+    REQUIRE (result.size() == 8);
+    REQUIRE_HEAD_MIN_MAX (result, 1, 9);
+  }
+
+  SECTION ("set intersection", "0")
+  {
+    SearchTree<int> result = set_intersection (tree_a, tree_b);
+
+    REQUIRE_TREE (result, "[ 4 5 6 ]", 1);
+    REQUIRE (result.size() == 3);
+    REQUIRE_HEAD (result, 4, 6, 5);
+  }
+
+  SECTION ("set difference", "0")
+  {
+    SearchTree<int> result = set_difference (tree_a, tree_b);
+
+    REQUIRE_TREE (result, "[ 1 2 3 ]", 1);
+    REQUIRE (result.size() == 3);
+    REQUIRE_HEAD (result, 1, 3, 2);
+
+    SearchTree<int> result_b = set_difference (tree_b, tree_a);
+
+    REQUIRE_TREE (result_b, "[ 7 9 ]", 1);
+  }
+
+  SECTION ("set operations - with empty tree", "0")
+  {
+    SearchTree<int> empty;
+
+    REQUIRE_TREE (set_union (tree_a, empty), "[ 1 2 3 4 5 6 ]", 2);
+    REQUIRE_TREE (set_intersection (tree_a, empty), "[ ]", -1);
+    REQUIRE_HEAD_NULL (set_intersection (tree_a, empty));
+    REQUIRE_TREE (set_difference (tree_a, empty), "[ 1 2 3 4 5 6 ]", 2);
+  }
+
+  SECTION ("set operations - operands unchanged", "0")
+  {
+    set_union (tree_a, tree_b);
+    set_intersection (tree_a, tree_b);
+    set_difference (tree_a, tree_b);
+
+    REQUIRE_TREE (tree_a, "[ 1 2 3 4 5 6 ]", 5);
+    REQUIRE_TREE (tree_b, "[ 4 5 6 7 9 ]", 4);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* LEVEL HISTOGRAM NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, erase, clear, copy constructor
+TEST_CASE ("level histogram", "0")
+{
+  SearchTree<int> tree;
+
+  SECTION ("level histogram - on empty tree", "0")
+  {
+    REQUIRE (tree.level_histogram().empty());
+    REQUIRE (tree.depth() == -1);
+  }
+
+  SECTION ("level histogram - after insert", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6, 1, 3, 5 });
+
+    REQUIRE (tree.level_histogram() == vector<size_t> ({ 1, 2, 3, 1 }));
+    REQUIRE (tree.depth() == 3);
+  }
+
+  SECTION ("level histogram - after erasing deepest node", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6, 1, 3, 5 });
+    tree.erase (5);
+
+    REQUIRE (tree.level_histogram() == vector<size_t> ({ 1, 2, 3 }));
+    REQUIRE (tree.depth() == 2);
+  }
+
+  SECTION ("level histogram - after erasing node with one child", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6, 1, 3, 5 });
+    tree.erase (7);
+
+    REQUIRE (tree.level_histogram() == vector<size_t> ({ 1, 2, 3 }));
+    REQUIRE (tree.depth() == 2);
+  }
+
+  SECTION ("level histogram - after erasing root", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6, 1, 3, 5 });
+    tree.erase (4);
+
+    size_t total = 0;
+    for (size_t count : tree.level_histogram())
+    {
+      total += count;
+    }
+
+    REQUIRE (total == 6);
+    REQUIRE (tree.level_histogram().size() == static_cast<size_t> (tree.depth() + 1));
+  }
+
+  SECTION ("level histogram - after clear", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6, 1, 3, 5 });
+    tree.clear();
+
+    REQUIRE (tree.level_histogram().empty());
+    REQUIRE (tree.depth() == -1);
+  }
+
+  SECTION ("level histogram - after copy construct", "0")
+  {
+    tree_insert (tree, { 1, 2, 3 });
+    SearchTree<int> tree_b (tree);
+
+    REQUIRE (tree_b.level_histogram() == vector<size_t> ({ 1, 1, 1 }));
+    REQUIRE (tree_b.depth() == 2);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* BATCH INSERT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, end, size
+TEST_CASE ("batch insert", "0")
+{
+  SearchTree<int> tree;
+
+  SECTION ("batch insert - into empty tree", "0")
+  {
+    vector<int> batch { 5, 3, 9, 1, 7 };
+
+    REQUIRE (tree.insert_batch (batch.begin(), batch.end()) == 5);
+    REQUIRE_TREE (tree, "[ 1 3 5 7 9 ]");
+    REQUIRE (tree.size() == 5);
+    REQUIRE_HEAD_MIN_MAX (tree, 1, 9);
+  }
+
+  SECTION ("batch insert - duplicate values", "0")
+  {
+    tree_insert (tree, { 4, 2, 6 });
+    vector<int> batch { 6, 1, 1, 4, 8, 2, 8 };
+
+    REQUIRE (tree.insert_batch (batch.begin(), batch.end()) == 2);
+    REQUIRE_TREE (tree, "[ 1 2 4 6 8 ]");
+    REQUIRE (tree.size() == 5);
+    REQUIRE_HEAD_MIN_MAX (tree, 1, 8);
+  }
+
+  SECTION ("batch insert - empty batch", "0")
+  {
+    tree_insert (tree, { 4, 2, 6 });
+    vector<int> batch;
+
+    REQUIRE (tree.insert_batch (batch.begin(), batch.end()) == 0);
+    REQUIRE_TREE (tree, "[ 2 4 6 ]", 1);
+    REQUIRE_HEAD (tree, 2, 6, 4);
+  }
+
+  SECTION ("batch insert - big batch", "0")
+  {
+    set<int> big_rand;
+    vector<int> batch;
+    big_rand_insert (tree, big_rand, 10000);
+
+    // Every third value in scrambled order, partly overlapping the tree.
+    for (int i = 0; i < 40000; i += 3)
+    {
+      int temp = (i * 7919) % 40000;
+      big_rand.insert (temp);
+      batch.push_back (temp);
+    }
+
+    size_t old_size = tree.size();
+    size_t inserted = tree.insert_batch (batch.begin(), batch.end());
+
+    REQUIRE (tree.size() == big_rand.size());
+    REQUIRE (inserted == big_rand.size() - old_size);
+    REQUIRE (equal (tree.begin(), tree.end(), big_rand.begin()));
+    REQUIRE (* tree.begin() == * big_rand.begin());
+    REQUIRE (* (--tree.end()) == * (--big_rand.end()));
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* PARALLEL FOR EACH AND REDUCE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+#include <atomic>
+
+using std::atomic;
+
+// Dependencies: insert
+TEST_CASE ("parallel for each and reduce", "0")
+{
+  SearchTree<int> tree;
+  set<int> big_rand;
+  big_rand_insert (tree, big_rand, 20000);
+
+  long long expected_sum = 0;
+  for (int value : big_rand)
+  {
+    expected_sum += value;
+  }
+
+  SECTION ("parallel for each - visits every value once", "0")
+  {
+    atomic<long long> sum (0);
+    atomic<size_t> count (0);
+
+    tree.parallel_for_each ([&] (const int& value) { sum += value; ++count; });
+
+    REQUIRE (sum == expected_sum);
+    REQUIRE (count == tree.size());
+  }
+
+  SECTION ("parallel reduce - sum", "0")
+  {
+    long long sum = tree.parallel_reduce (0LL,
+      [] (long long a, long long b) { return a + b; });
+
+    REQUIRE (sum == expected_sum);
+  }
+
+  // Concatenation is associative but not commutative, so this only passes in order.
+  SECTION ("parallel reduce - in order", "0")
+  {
+    SearchTree<string> string_tree;
+    tree_insert (string_tree, { "m", "d", "t", "a", "g", "p", "z", "b", "e", "h", "q" });
+
+    string result = string_tree.parallel_reduce (string (),
+      [] (const string& a, const string& b) { return a + b; });
+
+    REQUIRE (result == "abdeghmpqtz");
+  }
+
+  SECTION ("parallel reduce - on empty tree", "0")
+  {
+    SearchTree<int> empty;
+
+    REQUIRE (empty.parallel_reduce (42, [] (int a, int b) { return a + b; }) == 42);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* HETEROGENEOUS LOOKUP NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+#include <functional>
+
+using std::less;
+
+// Dependencies: insert, find, erase, end, size, lower bound
+TEST_CASE ("heterogeneous lookup", "0")
+{
+  // less<> is transparent, so lookups take a const char* without building a string.
+  // The helpers only take SearchTree<T>, so this test calls the tree directly.
+  SearchTree<string, less<>> tree;
+  tree.insert ("my");
+  tree.insert ("name");
+  tree.insert ("jeff");
+
+  SECTION ("heterogeneous lookup - find", "0")
+  {
+    const char* key = "jeff";
+
+    REQUIRE (tree.find (key).m_nodePtr->data == "jeff");
+    REQUIRE (tree.find ("bob") == tree.end());
+  }
+
+  SECTION ("heterogeneous lookup - lower bound", "0")
+  {
+    REQUIRE (* tree.lower_bound ("k") == "my");
+    REQUIRE (tree.lower_bound ("z") == tree.end());
+  }
+
+  SECTION ("heterogeneous lookup - erase", "0")
+  {
+    tree.erase ("my");
+
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    REQUIRE (stream.str () == "[ jeff name ]");
+    REQUIRE (tree.size() == 2);
+    REQUIRE (tree.end().m_nodePtr->right->data == "jeff");
+    REQUIRE (tree.end().m_nodePtr->left->data == "name");
+  }
+
+  SECTION ("heterogeneous lookup - default comparator unchanged", "0")
+  {
+    SearchTree<string> plain_tree;
+    tree_insert (plain_tree, { "my", "name", "jeff" });
+
+    REQUIRE (plain_tree.find (string ("name")).m_nodePtr->data == "name");
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* EMPLACE AND MOVE INSERT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+#include <functional>
+
+using std::less;
+
+// Counts how many times a value is built, copied and moved.
+struct Tracked
+{
+  static int constructs;
+  static int copies;
+  static int moves;
+
+  int value;
+
+  // Default argument lets the tree default-construct its head node.
+  Tracked (int v = 0) : value (v) { ++constructs; }
+  Tracked (const Tracked& other) : value (other.value) { ++copies; }
+  Tracked (Tracked&& other) : value (other.value) { ++moves; }
+
+  static void reset () { constructs = copies = moves = 0; }
+};
+
+int Tracked::constructs = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+bool operator< (const Tracked& a, const Tracked& b) { return a.value < b.value; }
+bool operator< (const Tracked& a, int b) { return a.value < b; }
+bool operator< (int a, const Tracked& b) { return a < b.value; }
+
+// less<> is transparent, so try_emplace can compare an int key against stored values
+// without building a Tracked for each comparison.
+typedef SearchTree<Tracked, less<>> TrackedTree;
+
+// Dependencies: insert, size
+TEST_CASE ("emplace and move insert", "0")
+{
+  TrackedTree tree;
+  tree.insert (Tracked (4));
+  tree.insert (Tracked (2));
+  Tracked::reset ();
+
+  SECTION ("move insert - no copies", "0")
+  {
+    pair<TrackedTree::iterator, bool> ret = tree.insert (Tracked (6));
+
+    REQUIRE (ret.second);
+    REQUIRE (ret.first.m_nodePtr->data.value == 6);
+    REQUIRE (Tracked::copies == 0);
+    REQUIRE (tree.size() == 3);
+  }
+
+  SECTION ("emplace - constructs once in place", "0")
+  {
+    pair<TrackedTree::iterator, bool> ret = tree.emplace (6);
+
+    REQUIRE (ret.second);
+    REQUIRE (ret.first.m_nodePtr->data.value == 6);
+    REQUIRE (Tracked::constructs == 1);
+    REQUIRE (Tracked::copies == 0);
+    REQUIRE (Tracked::moves == 0);
+  }
+
+  SECTION ("emplace - duplicate value", "0")
+  {
+    pair<TrackedTree::iterator, bool> ret = tree.emplace (4);
+
+    REQUIRE_FALSE (ret.second);
+    REQUIRE (tree.size() == 2);
+    REQUIRE (Tracked::copies == 0);
+  }
+
+  SECTION ("try emplace - new key", "0")
+  {
+    pair<TrackedTree::iterator, bool> ret = tree.try_emplace (3);
+
+    REQUIRE (ret.second);
+    REQUIRE (ret.first.m_nodePtr->data.value == 3);
+    REQUIRE (Tracked::constructs == 1);
+    REQUIRE (tree.size() == 3);
+  }
+
+  SECTION ("try emplace - existing key constructs nothing", "0")
+  {
+    pair<TrackedTree::iterator, bool> ret = tree.try_emplace (2);
+
+    REQUIRE_FALSE (ret.second);
+    REQUIRE (Tracked::constructs == 0);
+    REQUIRE (Tracked::copies == 0);
+    REQUIRE (Tracked::moves == 0);
+    REQUIRE (tree.size() == 2);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* NODE EXTRACT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, find, end
+TEST_CASE ("node extract", "0")
+{
+  SearchTree<int> tree_a;
+  SearchTree<int> tree_b;
+  tree_insert (tree_a, { 4, 2, 6, 1, 3, 5, 7 });
+  tree_insert (tree_b, { 10, 8 });
+
+  const Node<int>* node_3 = tree_a.find (3).m_nodePtr;
+
+  SECTION ("extract - by iterator", "0")
+  {
+    SearchTree<int>::node_type handle = tree_a.extract (tree_a.find (3));
+
+    REQUIRE_FALSE (handle.empty());
+    REQUIRE (handle.value() == 3);
+    REQUIRE_TREE (tree_a, "[ 1 2 4 5 6 7 ]", 2);
+    REQUIRE (tree_a.size() == 6);
+  }
+
+  SECTION ("extract - by key", "0")
+  {
+    SearchTree<int>::node_type handle = tree_a.extract (7);
+
+    REQUIRE (handle.value() == 7);
+    REQUIRE (tree_a.size() == 6);
+    REQUIRE_HEAD (tree_a, 1, 6, 4);
+  }
+
+  SECTION ("extract - missing key", "0")
+  {
+    SearchTree<int>::node_type handle = tree_a.extract (9);
+
+    REQUIRE (handle.empty());
+    REQUIRE (tree_a.size() == 7);
+  }
+
+  SECTION ("extract - last value", "0")
+  {
+    SearchTree<int> tree_c;
+    tree_c.insert (1);
+    SearchTree<int>::node_type handle = tree_c.extract (1);
+
+    REQUIRE_TREE (tree_c, "[ ]", -1);
+    REQUIRE_HEAD_NULL (tree_c);
+  }
+
+  // Mirrors the standard node handle API: insert returns the position, whether the node was
+  // linked, and the node itself when it was rejected.
+  SECTION ("insert node - into other tree", "0")
+  {
+    SearchTree<int>::insert_return_type ret = tree_b.insert (tree_a.extract (3));
+
+    REQUIRE (ret.inserted);
+    REQUIRE (ret.node.empty());
+    // Same node, no delete and new.
+    REQUIRE (ret.position.m_nodePtr == node_3);
+    REQUIRE (tree_b.find (3).m_nodePtr == node_3);
+    REQUIRE_TREE (tree_b, "[ 3 8 10 ]", 2);
+    REQUIRE (tree_b.size() == 3);
+    REQUIRE_HEAD (tree_b, 3, 10, 10);
+  }
+
+  SECTION ("insert node - duplicate value", "0")
+  {
+    tree_b.insert (3);
+    SearchTree<int>::insert_return_type ret = tree_b.insert (tree_a.extract (3));
+
+    REQUIRE_FALSE (ret.inserted);
+    REQUIRE (ret.position.m_nodePtr->data == 3);
+    REQUIRE (ret.position.m_nodePtr != node_3);
+    // Rejected node comes back through the result.
+    REQUIRE_FALSE (ret.node.empty());
+    REQUIRE (& ret.node.value() == & node_3->data);
+    REQUIRE (tree_b.size() == 3);
+  }
+
+  SECTION ("insert node - empty handle", "0")
+  {
+    SearchTree<int>::insert_return_type ret = tree_b.insert (SearchTree<int>::node_type ());
+
+    REQUIRE_FALSE (ret.inserted);
+    REQUIRE (ret.node.empty());
+    REQUIRE (ret.position == tree_b.end());
+    REQUIRE (tree_b.size() == 2);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SNAPSHOT NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: insert, erase
+TEST_CASE ("snapshot", "0")
+{
+  SearchTree<int> tree;
+  tree_insert (tree, { 40, 20, 60, 10, 30, 50, 70 });
+
+  // lower_bound on a snapshot returns a pointer to the value, or nullptr past the maximum.
+  SECTION ("snapshot - lower bound", "0")
+  {
+    SearchTree<int>::snapshot_type snap = tree.snapshot();
+
+    REQUIRE (snap.size() == 7);
+    REQUIRE (* snap.lower_bound (30) == 30);
+    REQUIRE (* snap.lower_bound (31) == 40);
+    REQUIRE (* snap.lower_bound (0) == 10);
+    REQUIRE (snap.lower_bound (71) == nullptr);
+  }
+
+  SECTION ("snapshot - contains", "0")
+  {
+    SearchTree<int>::snapshot_type snap = tree.snapshot();
+
+    REQUIRE (snap.contains (10));
+    REQUIRE (snap.contains (70));
+    REQUIRE_FALSE (snap.contains (35));
+  }
+
+  SECTION ("snapshot - separate from tree", "0")
+  {
+    SearchTree<int>::snapshot_type snap = tree.snapshot();
+    tree.insert (35);
+    tree.erase (40);
+
+    REQUIRE (snap.size() == 7);
+    REQUIRE (snap.contains (40));
+    REQUIRE_FALSE (snap.contains (35));
+  }
+
+  SECTION ("snapshot - on empty tree", "0")
+  {
+    SearchTree<int> empty;
+    SearchTree<int>::snapshot_type snap = empty.snapshot();
+
+    REQUIRE (snap.size() == 0);
+    REQUIRE (snap.lower_bound (0) == nullptr);
+    REQUIRE_FALSE (snap.contains (0));
+  }
+
+  SECTION ("snapshot - big tree", "0")
+  {
+    set<int> big_rand { 40, 20, 60, 10, 30, 50, 70 };
+    big_rand_insert (tree, big_rand, 20000);
+
+    SearchTree<int>::snapshot_type snap = tree.snapshot();
+    REQUIRE (snap.size() == big_rand.size());
+
+    // Done without "REQUIRE" per value to avoid long error messages.
+    for (int i = -1; i <= 40001; ++i)
+    {
+      set<int>::iterator expected = big_rand.lower_bound (i);
+      const int* actual = snap.lower_bound (i);
+
+      if ((expected == big_rand.end()) != (actual == nullptr)
+          || (actual != nullptr && * actual != * expected))
+      {
+        FAIL ("Snapshot lower bound incorrect for " + to_string (i) + ".");
+      }
+    }
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SPARSE LEVEL ORDER NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+using std::count;
+
+// Dependencies: insert, depth, size, print level order
+TEST_CASE ("print sparse level order", "0")
+{
+  SearchTree<int> tree;
+  ostringstream stream;
+
+  // Same levels as print level order, but only present nodes, each as
+  // "position:value" with its position in the fully padded level.
+  SECTION ("print sparse level order - on empty tree", "0")
+  {
+    tree.printLevelOrderSparse (stream);
+
+    REQUIRE (stream.str () == "[ ]");
+  }
+
+  SECTION ("print sparse level order - on tree with just a root", "0")
+  {
+    tree.insert (42);
+    tree.printLevelOrderSparse (stream);
+
+    REQUIRE (stream.str () == "[ 0:42 ]");
+  }
+
+  SECTION ("print sparse level order - on simple tree", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6 });
+    tree.printLevelOrderSparse (stream);
+
+    REQUIRE (stream.str () == "[ 0:4 | 0:2 1:7 | 2:6 ]");
+  }
+
+  SECTION ("print sparse level order - on skewed tree", "0")
+  {
+    tree_insert (tree, { 1, 2, 4, 3, 5, 6 });
+    tree.printLevelOrderSparse (stream);
+
+    REQUIRE (stream.str () == "[ 0:1 | 1:2 | 3:4 | 6:3 7:5 | 15:6 ]");
+  }
+
+  SECTION ("print sparse level order - classic output unchanged", "0")
+  {
+    tree_insert (tree, { 4, 2, 7, 6 });
+    tree.printLevelOrderSparse (stream);
+
+    REQUIRE_LEVEL_ORDER (tree, "[ 4 | 2 7 | - - 6 - ]");
+  }
+
+  // Classic output for this tree would need about 2^31 slots.
+  SECTION ("print sparse level order - on deep tree", "0")
+  {
+    set<int> big_rand;
+    big_rand_insert (tree, big_rand, 20000);
+    tree.printLevelOrderSparse (stream);
+
+    string out = stream.str ();
+
+    REQUIRE (count (out.begin(), out.end(), ':') == static_cast<long> (tree.size()));
+    REQUIRE (count (out.begin(), out.end(), '|') == tree.depth());
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* DEEP TREE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+// Dependencies: hinted insert, end, size, clear, copy constructor
+TEST_CASE ("deep tree", "0")
+{
+  // Hinted insert at end() builds the chain in linear time. Recursive depth, printInOrder,
+  // copy or clear would need 100,000 stack frames on it.
+  SearchTree<int> tree;
+  string deep_string = "[ ";
+
+  for (int i = 0; i < 100000; ++i)
+  {
+    tree.insert (tree.end(), i);
+    deep_string += to_string (i) + " ";
+  }
+  deep_string += "]";
+
+  SECTION ("deep tree - depth and print in order", "0")
+  {
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != deep_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (tree.depth() == 99999);
+    REQUIRE (tree.size() == 100000);
+    REQUIRE_HEAD (tree, 0, 99999, 0);
+  }
+
+  SECTION ("deep tree - copy constructor", "0")
+  {
+    SearchTree<int> tree_b (tree);
+
+    REQUIRE (tree_b.depth() == 99999);
+    REQUIRE (tree_b.size() == 100000);
+    REQUIRE_HEAD (tree_b, 0, 99999, 0);
+  }
+
+  SECTION ("deep tree - clear", "0")
+  {
+    tree.clear ();
+
+    REQUIRE_TREE (tree, "[ ]", -1);
+    REQUIRE (tree.size() == 0);
+    REQUIRE_HEAD_NULL (tree);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* RED-BLACK MODE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+using std::log2;
+
+// Dependencies: insert, erase, end, size, depth, print in order
+TEST_CASE ("red-black mode", "0")
+{
+  // The policy is a constructor tag, so the tree is still a SearchTree<int> and the
+  // helpers below apply to it unchanged.
+  SearchTree<int> tree (red_black_policy);
+  string sorted_string = "[ ";
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    tree.insert (i);
+    sorted_string += to_string (i) + " ";
+  }
+  sorted_string += "]";
+
+  SECTION ("red-black mode - sorted insert", "0")
+  {
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != sorted_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (tree.depth() <= 2 * log2 (20000 + 1));
+    REQUIRE (tree.size() == 20000);
+    REQUIRE_HEAD_MIN_MAX (tree, 0, 19999);
+  }
+
+  SECTION ("red-black mode - erase", "0")
+  {
+    string odd_string = "[ ";
+    for (int i = 0; i < 20000; ++i)
+    {
+      if (i % 2 == 0)
+      {
+        REQUIRE (tree.erase (i));
+      }
+      else
+      {
+        odd_string += to_string (i) + " ";
+      }
+    }
+    odd_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != odd_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (tree.depth() <= 2 * log2 (10000 + 1));
+    REQUIRE (tree.size() == 10000);
+    REQUIRE_HEAD_MIN_MAX (tree, 1, 19999);
+  }
+
+  SECTION ("red-black mode - erase everything", "0")
+  {
+    for (int i = 19999; i >= 0; --i)
+    {
+      REQUIRE (tree.erase (i));
+    }
+
+    REQUIRE_TREE (tree, "[ ]", -1);
+    REQUIRE (tree.size() == 0);
+    REQUIRE_HEAD_NULL (tree);
+  }
+
+  SECTION ("red-black mode - random insert", "0")
+  {
+    SearchTree<int> tree_b (red_black_policy);
+    set<int> big_rand;
+    big_rand_insert (tree_b, big_rand, 20000);
+
+    string rand_string = "[ ";
+    for (int value : big_rand)
+    {
+      rand_string += to_string (value) + " ";
+    }
+    rand_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree_b.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != rand_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (tree_b.depth() <= 2 * log2 (big_rand.size() + 1));
+    REQUIRE (tree_b.size() == big_rand.size());
+    REQUIRE_HEAD_MIN_MAX (tree_b, *big_rand.begin (), *big_rand.rbegin ());
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SPLAY MODE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+using std::max;
+using std::min;
+
+// Dependencies: insert, find, erase, begin, end, size, iterator increment, iterator dereference
+TEST_CASE ("splay mode", "0")
+{
+  // Splaying moves the accessed node to the root. The rest of the shape depends on
+  // the splay variant, so contents are checked in order and only the root is pinned.
+  SearchTree<int> tree (splay_policy);
+  vector<int> values = { 4, 2, 6, 1, 3, 5, 7 };
+  tree_insert (tree, values);
+
+  SECTION ("splay mode - insert", "0")
+  {
+    SearchTree<int> tree_b (splay_policy);
+    int low = values[0];
+    int high = values[0];
+
+    for (int value : values)
+    {
+      tree_b.insert (value);
+      low = min (low, value);
+      high = max (high, value);
+
+      REQUIRE_HEAD (tree_b, low, high, value);
+    }
+
+    REQUIRE_TREE (tree_b, "[ 1 2 3 4 5 6 7 ]");
+    REQUIRE (tree_b.size() == 7);
+  }
+
+  SECTION ("splay mode - find", "0")
+  {
+    for (int value : { 3, 7, 1, 5, 5, 4 })
+    {
+      REQUIRE (*tree.find (value) == value);
+      REQUIRE_HEAD (tree, 1, 7, value);
+    }
+
+    REQUIRE_TREE (tree, "[ 1 2 3 4 5 6 7 ]");
+    REQUIRE (tree.size() == 7);
+  }
+
+  SECTION ("splay mode - find missing", "0")
+  {
+    REQUIRE (tree.find (8) == tree.end());
+    REQUIRE (tree.find (0) == tree.end());
+
+    REQUIRE_TREE (tree, "[ 1 2 3 4 5 6 7 ]");
+    REQUIRE_HEAD_MIN_MAX (tree, 1, 7);
+  }
+
+  SECTION ("splay mode - iterate after find", "0")
+  {
+    tree.find (6);
+    tree.find (2);
+
+    vector<int> sorted = { 1, 2, 3, 4, 5, 6, 7 };
+    REQUIRE (equal (tree.begin(), tree.end(), sorted.begin()));
+  }
+
+  SECTION ("splay mode - erase after find", "0")
+  {
+    tree.find (4);
+    REQUIRE (tree.erase (4));
+    tree.find (7);
+    REQUIRE (tree.erase (1));
+
+    REQUIRE_TREE (tree, "[ 2 3 5 6 7 ]");
+    REQUIRE (tree.size() == 5);
+    REQUIRE_HEAD_MIN_MAX (tree, 2, 7);
+  }
+
+  SECTION ("splay mode - big tree", "0")
+  {
+    SearchTree<int> tree_b (splay_policy);
+    set<int> big_rand;
+    big_rand_insert (tree_b, big_rand, 20000);
+
+    int low = *big_rand.begin ();
+    int high = *big_rand.rbegin ();
+    int count = 0;
+
+    for (auto iter = big_rand.begin (); count < 100; ++iter, ++count)
+    {
+      REQUIRE (*tree_b.find (*iter) == *iter);
+      REQUIRE_HEAD (tree_b, low, high, *iter);
+    }
+
+    REQUIRE (tree_b.size() == big_rand.size());
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* TREAP MODE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+using std::log2;
+
+// Dependencies: insert, erase, size, depth, print in order, print level order, copy constructor
+TEST_CASE ("treap mode", "0")
+{
+  // Priorities come from the seed given to the constructor, so the same seed and the
+  // same inserts must give the same shape.
+  SearchTree<int> tree_a (treap_policy, 42);
+  SearchTree<int> tree_b (treap_policy, 42);
+  vector<int> values;
+
+  for (int i = 0; i < 32; ++i)
+  {
+    values.push_back ((i * 13) % 32);
+  }
+  tree_insert (tree_a, values);
+  tree_insert (tree_b, values);
+
+  SECTION ("treap mode - same seed", "0")
+  {
+    ostringstream stream_a;
+    ostringstream stream_b;
+    stream_a << tree_a;
+    stream_b << tree_b;
+
+    REQUIRE (stream_a.str () == stream_b.str ());
+    REQUIRE (tree_a.depth() == tree_b.depth());
+    REQUIRE (tree_a.size() == 32);
+  }
+
+  SECTION ("treap mode - copy constructor", "0")
+  {
+    SearchTree<int> tree_c (tree_a);
+
+    ostringstream stream_a;
+    ostringstream stream_c;
+    stream_a << tree_a;
+    stream_c << tree_c;
+
+    REQUIRE (stream_a.str () == stream_c.str ());
+  }
+
+  SECTION ("treap mode - sorted insert", "0")
+  {
+    SearchTree<int> tree_c (treap_policy, 42);
+    string sorted_string = "[ ";
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      tree_c.insert (i);
+      sorted_string += to_string (i) + " ";
+    }
+    sorted_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree_c.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != sorted_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    // Expected treap depth is about 3 * log2 (n); 4 * log2 (n + 1) leaves room for the seed.
+    REQUIRE (tree_c.depth() <= 4 * log2 (20000 + 1));
+    REQUIRE (tree_c.size() == 20000);
+    REQUIRE_HEAD_MIN_MAX (tree_c, 0, 19999);
+  }
+
+  SECTION ("treap mode - erase", "0")
+  {
+    for (int i = 0; i < 32; i += 2)
+    {
+      REQUIRE (tree_a.erase (i));
+    }
+
+    REQUIRE_TREE (tree_a, "[ 1 3 5 7 9 11 13 15 17 19 21 23 25 27 29 31 ]");
+    REQUIRE (tree_a.size() == 16);
+    REQUIRE_HEAD_MIN_MAX (tree_a, 1, 31);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* CONCURRENT READERS NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+ * LINK WITH -pthread
+#include <atomic>
+#include <thread>
+
+using std::atomic;
+using std::thread;
+
+// Dependencies: insert, erase, contains, size, print in order
+TEST_CASE ("concurrent readers", "0")
+{
+  // Readers only look up the even keys, which the writer never touches, so every
+  // lookup must succeed no matter how it interleaves with the writes.
+  ConcurrentSearchTree<int> tree;
+  string even_string = "[ ";
+
+  for (int i = 0; i < 20000; i += 2)
+  {
+    tree.insert (i);
+    even_string += to_string (i) + " ";
+  }
+  even_string += "]";
+
+  atomic<bool> done (false);
+  atomic<int> misses (0);
+  atomic<int> reads (0);
+
+  auto reader = [&] ()
+  {
+    do
+    {
+      for (int i = 0; i < 20000; i += 2)
+      {
+        if (! tree.contains (i))
+        {
+          ++misses;
+        }
+        ++reads;
+      }
+    } while (! done);
+  };
+
+  SECTION ("concurrent readers - finds during inserts", "0")
+  {
+    vector<thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+      readers.push_back (thread (reader));
+    }
+
+    for (int i = 1; i < 20000; i += 2)
+    {
+      tree.insert (i);
+    }
+    done = true;
+
+    for (thread& t : readers)
+    {
+      t.join ();
+    }
+
+    string all_string = "[ ";
+    for (int i = 0; i < 20000; ++i)
+    {
+      all_string += to_string (i) + " ";
+    }
+    all_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != all_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (misses == 0);
+    REQUIRE (reads >= 4 * 10000);
+    REQUIRE (tree.size() == 20000);
+  }
+
+  SECTION ("concurrent readers - finds during erases", "0")
+  {
+    for (int i = 1; i < 20000; i += 2)
+    {
+      tree.insert (i);
+    }
+
+    vector<thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+      readers.push_back (thread (reader));
+    }
+
+    for (int i = 1; i < 20000; i += 2)
+    {
+      tree.erase (i);
+    }
+    done = true;
+
+    for (thread& t : readers)
+    {
+      t.join ();
+    }
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != even_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (misses == 0);
+    REQUIRE (reads >= 4 * 10000);
+    REQUIRE (tree.size() == 10000);
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+/* SHARDED TREE NOT PART OF ASSIGNMENT
+ * UNCOMMENT IF ADDED TO ASSIGNMENT
+ * ASSIGN POINT VALUES TO SECTIONS AND TAKE THEM FROM OTHER TESTS
+ * LINK WITH -pthread
+#include <atomic>
+#include <thread>
+
+using std::atomic;
+using std::distance;
+using std::thread;
+
+// Dependencies: insert, size, begin, end, iterator increment, iterator dereference,
+//   print in order
+TEST_CASE ("sharded tree", "0")
+{
+  // More writers than shards, so several threads share each shard lock.
+  ShardedSearchTree<int, 4> tree;
+  atomic<int> inserted (0);
+
+  auto writer = [&] (int id)
+  {
+    // Keys below 1000 are written by every thread; the rest are split by id.
+    for (int i = 0; i < 20000; ++i)
+    {
+      if ((i < 1000 || i % 8 == id) && tree.insert (i))
+      {
+        ++inserted;
+      }
+    }
+  };
+
+  vector<thread> writers;
+  for (int id = 0; id < 8; ++id)
+  {
+    writers.push_back (thread (writer, id));
+  }
+
+  for (thread& t : writers)
+  {
+    t.join ();
+  }
+
+  SECTION ("sharded tree - duplicates rejected", "0")
+  {
+    REQUIRE (inserted == 20000);
+    REQUIRE (tree.size() == 20000);
+    REQUIRE (! tree.insert (0));
+    REQUIRE (! tree.insert (19999));
+  }
+
+  SECTION ("sharded tree - merged iteration", "0")
+  {
+    vector<int> sorted;
+    for (int i = 0; i < 20000; ++i)
+    {
+      sorted.push_back (i);
+    }
+
+    REQUIRE (distance (tree.begin(), tree.end()) == 20000);
+    REQUIRE (equal (tree.begin(), tree.end(), sorted.begin()));
+  }
+
+  SECTION ("sharded tree - print in order", "0")
+  {
+    string sorted_string = "[ ";
+    for (int i = 0; i < 20000; ++i)
+    {
+      sorted_string += to_string (i) + " ";
+    }
+    sorted_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree.printInOrder (stream);
+    stream << "]";
+
+    if (stream.str () != sorted_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+  }
+}
+*/
+/*----------------------------------------------------------*/
+
+// Dependencies: insert, erase, end, clear, iterator dereference, copy constructor
+TEST_CASE ("stress test", "2")
+{
+  SECTION ("stress test", "[2.00]")
+  {
+    SearchTree<int> tree_a;
+
+    set<int> big_rand;
+    mt19937 gen (0);
+    int root = (gen () % 1000 ) + 19500;
+    big_rand.insert (root);
+    tree_a.insert(root);
+
+    for (int i = 1; i < 20000; ++i)
+    {
+      int temp = gen () % 40000;
+      big_rand.insert (temp);
+      tree_a.insert(temp);
+    }
+
+    int min = * big_rand.begin();
+    int max = * (--big_rand.end());
+
+    string big_rand_string = "[ ";
+    for (int num : big_rand)
+    {
+      big_rand_string += to_string(num) + " ";
+    }
+    big_rand_string += "]";
+
+    // Done without "REQUIRE" to avoid long error messages.
+    ostringstream stream;
+    stream << "[ ";
+    tree_a.printInOrder (stream);
+    stream << "]";
+    if (stream.str () != big_rand_string)
+    {
+      FAIL ("Tree state incorrect. Tree size too large to display.");
+    }
+
+    REQUIRE (tree_a.depth() == 30);
+    REQUIRE (tree_a.size() == big_rand.size());
+    REQUIRE_HEAD (tree_a, min, max, root);
+
+    SearchTree<int> tree_b (tree_a);
+    tree_b.clear ();
+
+    REQUIRE_TREE (tree_b, "[ ]", -1);
+    REQUIRE (tree_b.size() == 0);
+    REQUIRE_HEAD_NULL (tree_b);
+
+    while (tree_a.size() > 0)
+    {
+      tree_a.erase (* (--tree_a.end()));
+    }
+
+    REQUIRE_TREE (tree_a, "[ ]", -1);
+    REQUIRE (tree_a.size() == 0);
+    REQUIRE_HEAD_NULL (tree_a);
+
+    tree_insert (tree_a, { 4, 2, 6, 1, 3, 5, 7 });
+
+    REQUIRE_TREE (tree_a, "[ 1 2 3 4 5 6 7 ]", 2);
+    REQUIRE (tree_a.size() == 7);
+    REQUIRE_HEAD (tree_a, 1, 7, 4);
+  }
+}
+
+/************************************************************/
+// Helpers
+
+template<typename T>
+void
+REQUIRE_TREE (const SearchTree<T>& tree, string treeString)
+{
+  ostringstream output;
+  output << "[ ";
+  tree.printInOrder(output);
+  output << "]";
+  REQUIRE (output.str () == treeString);
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_TREE (const SearchTree<T>& tree, string treeString, int depth)
+{
+  REQUIRE_TREE (tree, treeString);
+  REQUIRE (tree.depth() == depth);
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_HEAD (const SearchTree<T>& tree, T right, T left, T parent)
+{
+  const Node<T>* head = tree.end().m_nodePtr;
+
+  REQUIRE (head->right != nullptr);
+  REQUIRE (head->left != nullptr);
+  REQUIRE (head->parent != nullptr);
+
+  REQUIRE (head->right != head);
+  REQUIRE (head->left != head);
+  REQUIRE (head->parent != head);
+
+  REQUIRE (head->right->data == right);
+  REQUIRE (head->left->data == left);
+  REQUIRE (head->parent->data == parent);
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_HEAD_MIN_MAX (const SearchTree<T>& tree, T right, T left)
+{
+  const Node<T>* head = tree.end().m_nodePtr;
+
+  REQUIRE (head->right != nullptr);
+  REQUIRE (head->left != nullptr);
+  REQUIRE (head->parent != nullptr);
+
+  REQUIRE (head->right != head);
+  REQUIRE (head->left != head);
+  REQUIRE (head->parent != head);
+
+  REQUIRE (head->right->data == right);
+  REQUIRE (head->left->data == left);
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_HEAD_NULL (const SearchTree<T>& tree)
+{
+  const Node<T>* head = tree.end().m_nodePtr;
+
+  REQUIRE (head->left == nullptr);
+  REQUIRE (head->right == nullptr);
+  REQUIRE (head->parent == nullptr);
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_LEVEL_ORDER (const SearchTree<T>& tree, string answer)
+{
+  ostringstream os;
+  string out, out_no_space, out_no_dash, answer_no_space, answer_no_dash;
+
+  os << tree;
+  out = os.str();
+
+  out_no_space = out_no_dash = out;
+  answer_no_dash = answer_no_space = answer;
+
+  out_no_space.erase(remove(out_no_space.begin(), out_no_space.end(), ' '), out_no_space.end());
+  out_no_dash.erase(remove(out_no_dash.begin(), out_no_dash.end(), '-'), out_no_dash.end());
+
+  answer_no_space.erase(remove(answer_no_space.begin(), answer_no_space.end(), ' '),
+    answer_no_space.end());
+  answer_no_dash.erase(remove(answer_no_dash.begin(), answer_no_dash.end(), '-'),
+    answer_no_dash.end());
+
+  CHECK (out == answer);
+
+  if (out != answer)
+  {
+    if (out_no_dash == answer_no_dash)
+    {
+      WARN ("Your output is correct except for dashes\n");
+    }
+    else if (out_no_space == answer_no_space)
+    {
+      WARN ("Your output is correct except for spaces\n");
+    }
+  }
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+REQUIRE_ALL_EQUAL (const vector<T>& values)
+{
+  T temp = NULL;
+
+  for (T value : values)
+  {
+    if (temp != NULL)
+    {
+      REQUIRE (temp == value);
+    }
+    temp = value;
+  }
+}
+
+/*----------------------------------------------------------*/
+
+void
+CHECK_AND_WARN (bool condition, string message)
+{
+  CHECK (condition);
+  if (!condition)
+  {
+    cout << message << "\n";
+  }
+}
+
+/*----------------------------------------------------------*/
+
+ostringstream
+CHECK_AND_WARN (bool condition, string message, ostringstream stream)
+{
+  CHECK (condition);
+  if (!condition)
+  {
+    stream << message << "\n";
+  }
+
+  return stream;
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+tree_insert (SearchTree<T>& tree, const vector<T>& values)
+{
+  for (const T& value : values)
+  {
+    tree.insert (value);
+  }
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+tree_erase (SearchTree<T>& tree, const vector<T>& values)
+{
+  for (const T& value : values)
+  {
+    tree.erase (value);
+  }
+}
+
+/*----------------------------------------------------------*/
+
+template<typename T>
+void
+big_rand_insert (SearchTree<T>& tree, set<T>& values, int count)
+{
+  mt19937 gen (0);
+
+  for (int i = 0; i < count; ++i)
+  {
+    T value = gen () % 40000;
+    values.insert (value);
+    tree.insert (value);
   }
 }
 